@@ -0,0 +1,73 @@
+#include <cliap/cliap.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    // The way lists were parsed before Arg::get_values_as
+    template<typename T>
+    std::vector<T> naive_split(const std::string& str, char sep) {
+        std::vector<T> result;
+        std::stringstream input{str};
+        std::string item;
+        while (std::getline(input, item, sep)) {
+            T value{};
+            std::stringstream ss{item};
+            ss >> value;
+            result.push_back(value);
+        }
+        return result;
+    }
+
+    template<typename Fn>
+    double measure_ms(int iterations, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            fn();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    template<typename T>
+    void run(const std::string& title, const std::string& list, int iterations) {
+        cliap::Arg arg;
+        arg.value(list);
+
+        std::vector<T> buf(list.size() / 2 + 1);
+        const auto count = arg.get_values_as<std::vector<T>>().size();
+
+        // Keeps the compiler from dropping the parsing work
+        volatile std::size_t sink{};
+
+        const auto naive = measure_ms(iterations, [&] { sink = sink + naive_split<T>(list, ',').size(); });
+        const auto vec = measure_ms(iterations, [&] { sink = sink + arg.get_values_as<std::vector<T>>().size(); });
+        const auto span = measure_ms(iterations, [&] { sink = sink + arg.get_values_as(buf.data(), buf.size()).size; });
+
+        std::cout << title << " (" << count << " elements per call)\n"
+                  << "    split + stringstream: " << naive << " ms\n"
+                  << "    get_values_as<vector>: " << vec << " ms\n"
+                  << "    get_values_as(buffer): " << span << " ms\n";
+    }
+}
+
+int main() {
+    constexpr int count = 100'000;
+    constexpr int iterations = 20;
+
+    std::string ids;
+    std::string weights;
+    for (int i = 0; i < count; ++i) {
+        const auto sep = i == 0 ? "" : ",";
+        ids += sep + std::to_string(i * 7);
+        weights += sep + std::to_string(i * 0.001);
+    }
+
+    run<std::uint32_t>("100k integers", ids, iterations);
+    run<double>("100k doubles", weights, iterations);
+
+    return 0;
+}
@@ -1,11 +1,56 @@
 #ifndef CLIAP_ARG_H
 #define CLIAP_ARG_H
 
+#include <algorithm>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 namespace cliap
 {
+    // Location of the list element that could not be converted and why:
+    // std::errc::invalid_argument - the element is empty or is not a number,
+    // std::errc::result_out_of_range - the number does not fit into the element type,
+    // std::errc::value_too_large - the caller provided buffer is full
+    struct ValueError {
+        std::size_t index{};    // element number
+        std::size_t position{}; // offset of the offending character in the value string
+        std::errc reason{};
+    };
+
+    namespace detail {
+        template<typename T>
+        using ValueSink = bool (*)(T value, void* ctx);
+
+        // Converts the elements of a separated list one by one and passes them to sink,
+        // stops at the first invalid element or when sink returns false.
+        // Defined in arg_values.cpp for the standard integer, character and floating point types.
+        template<typename T>
+        std::optional<ValueError> parse_values(std::string_view str, char sep, ValueSink<T> sink, void* ctx,
+                                               std::string_view* bad_element = nullptr);
+
+        [[noreturn]] void throw_value_error(const ValueError& err, std::string_view element);
+
+        template<typename Container, typename = void>
+        struct has_reserve : std::false_type {};
+
+        template<typename Container>
+        struct has_reserve<Container, std::void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>>
+            : std::true_type {};
+    }
+
+    // Elements converted into a caller provided buffer
+    template<typename T>
+    struct Values {
+        T* data{};
+        std::size_t size{};
+        std::optional<ValueError> error;
+    };
+
     class Arg {
     public:
         Arg() = default;
@@ -42,6 +87,54 @@ namespace cliap
             return result;
         }
 
+        // Converts a separated list like "1,2,3" into any container with push_back,
+        // throws std::runtime_error on the first invalid element.
+        // Whitespace around elements and a leading '+' are allowed, empty elements are not.
+        // Containers with reserve() are sized up front by one extra std::count pass over the value.
+        template<typename Container>
+        Container get_values_as(char sep = ',') const {
+            using T = typename Container::value_type;
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "List elements must be numbers");
+
+            Container result;
+            if constexpr (detail::has_reserve<Container>::value)
+                result.reserve(static_cast<std::size_t>(std::count(value_.cbegin(), value_.cend(), sep)) + 1);
+
+            std::string_view bad_element;
+            const auto err = detail::parse_values<T>(value_, sep, [](T v, void* ctx) {
+                static_cast<Container*>(ctx)->push_back(v);
+                return true;
+            }, &result, &bad_element);
+
+            if (err)
+                detail::throw_value_error(*err, bad_element);
+
+            return result;
+        }
+
+        // Converts a separated list into out[0..capacity), stops at the first invalid element.
+        // Elements that do not fit into the buffer are reported with std::errc::value_too_large.
+        template<typename T>
+        Values<T> get_values_as(T* out, std::size_t capacity, char sep = ',') const {
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "List elements must be numbers");
+
+            struct Buffer {
+                Values<T> values;
+                std::size_t capacity;
+            } buffer{{out, 0, {}}, capacity};
+
+            buffer.values.error = detail::parse_values<T>(value_, sep, [](T v, void* ctx) {
+                auto& buf = *static_cast<Buffer*>(ctx);
+                if (buf.values.size == buf.capacity)
+                    return false;
+
+                buf.values.data[buf.values.size++] = v;
+                return true;
+            }, &buffer);
+
+            return buffer.values;
+        }
+
         const std::string& get_value_as_str() const { return value_; }
 
     private:
@@ -4,8 +4,13 @@
 #include <cliap/arg.h>
 
 #include <algorithm>
+#include <functional>
+#include <istream>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -14,12 +19,35 @@ namespace cliap
     class ArgParser {
         using ArgPtr = std::shared_ptr<Arg>;
     public:
+        // Called every time a parameter is matched, including repeated occurrences
+        using ArgCallback = std::function<void(const Arg&)>;
+
         ArgParser& add_parameter(Arg parm);
 
         std::optional<std::string> parse(const std::vector<std::string>& args);
 
         std::optional<std::string> parse(int argc, char* argv[]);
 
+        // Parses tokens one by one without the program name in front.
+        // Only the key awaiting its value is kept between tokens,
+        // required parameters are checked when the input is exhausted.
+        template<typename InputIt>
+        std::optional<std::string> parse(InputIt first, InputIt last, const ArgCallback& on_arg = {}) {
+            std::string pending_key;
+
+            for (; first != last; ++first) {
+                if (auto err = parse_token(*first, pending_key, on_arg))
+                    return err;
+            }
+
+            return finish_parse(pending_key);
+        }
+
+        // Parses one token per line (or per delim) until the end of the stream,
+        // so values may contain spaces. With '\n' a trailing '\r' is dropped (CRLF input).
+        // Empty lines are skipped, but an empty line where a key expects its value is an error.
+        std::optional<std::string> parse(std::istream& input, const ArgCallback& on_arg = {}, char delim = '\n');
+
         void add_usage_string(std::string usage_string);
 
         void print_help();
@@ -48,6 +76,10 @@ namespace cliap
 
         std::optional<std::string> check_required_args() const;
 
+        std::optional<std::string> parse_token(std::string_view token, std::string& pending_key, const ArgCallback& on_arg);
+
+        std::optional<std::string> finish_parse(const std::string& pending_key) const;
+
         std::unordered_map<std::string, ArgPtr> params_map_;
         std::vector<std::string> usage_examples_;
 
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <cliap/arg.h>
+
+namespace cliap
+{
+    namespace {
+        template<typename T>
+        std::from_chars_result from_chars(const char* first, const char* last, T& value) {
+#if !defined(__cpp_lib_to_chars)
+            // Floating point std::from_chars is missing in older standard libraries
+            // (libstdc++ before GCC 11, libc++ before LLVM 20), use a C locale stream instead
+            if constexpr (std::is_floating_point_v<T>) {
+                std::istringstream ss{std::string{first, last}};
+                ss.imbue(std::locale::classic());
+                ss >> value;
+
+                // On overflow the stream stores the largest value, on bad input zero
+                if (ss.fail())
+                    return {first, value != T{} ? std::errc::result_out_of_range : std::errc::invalid_argument};
+
+                const auto consumed = ss.eof() ? last - first : static_cast<std::ptrdiff_t>(ss.tellg());
+                return {first + consumed, std::errc{}};
+            } else
+#endif
+            return std::from_chars(first, last, value);
+        }
+
+        bool is_space(char ch)
+        {
+            return std::isspace(static_cast<unsigned char>(ch)) != 0;
+        }
+    }
+
+    namespace detail {
+        template<typename T>
+        std::optional<ValueError> parse_values(std::string_view str, char sep, ValueSink<T> sink, void* ctx,
+                                               std::string_view* bad_element)
+        {
+            if (str.empty())
+                return {};
+
+            const char* const begin = str.data();
+            const char* const end = begin + str.size();
+
+            for (std::size_t index{}, cur{};; ++index) {
+                // memchr is vectorized by the C runtime, so long lists are scanned in wide chunks
+                const auto* next = static_cast<const char*>(std::memchr(begin + cur, sep, str.size() - cur));
+                if (next == nullptr)
+                    next = end;
+
+                const auto fail = [&](std::size_t pos, std::errc reason) {
+                    if (bad_element)
+                        *bad_element = std::string_view{begin + cur, static_cast<std::size_t>(next - begin) - cur};
+
+                    return ValueError{index, pos, reason};
+                };
+
+                const char* first = begin + cur;
+                const char* last = next;
+                while (first != last && is_space(*first))
+                    ++first;
+                while (last != first && is_space(*(last - 1)))
+                    --last;
+
+                // Empty element: point at its start, or at the separator when it ends the value
+                if (first == last)
+                    return fail(std::min(cur, str.size() - 1), std::errc::invalid_argument);
+
+                const auto element_pos = static_cast<std::size_t>(first - begin);
+
+                // std::from_chars does not accept the sign that stringstream does
+                if (*first == '+' && last - first > 1 && *(first + 1) != '-')
+                    ++first;
+
+                T v{};
+                const auto [ptr, ec] = from_chars(first, last, v);
+
+                if (ec != std::errc{})
+                    return fail(element_pos, ec);
+
+                if (ptr != last)
+                    return fail(static_cast<std::size_t>(ptr - begin), std::errc::invalid_argument);
+
+                if (!sink(v, ctx))
+                    return fail(element_pos, std::errc::value_too_large);
+
+                if (next == end)
+                    return {};
+
+                cur = static_cast<std::size_t>(next - begin) + 1;
+            }
+        }
+
+        void throw_value_error(const ValueError& err, std::string_view element)
+        {
+            throw std::runtime_error("Invalid list element #" + std::to_string(err.index)
+                + " at position " + std::to_string(err.position)
+                + (err.reason == std::errc::result_out_of_range ? " (out of range): '" : " (not a number): '")
+                + std::string{element} + "'");
+        }
+
+#define CLIAP_INSTANTIATE_PARSE_VALUES(T) \
+        template std::optional<ValueError> parse_values<T>(std::string_view, char, ValueSink<T>, void*, std::string_view*);
+
+        CLIAP_INSTANTIATE_PARSE_VALUES(char)
+        CLIAP_INSTANTIATE_PARSE_VALUES(signed char)
+        CLIAP_INSTANTIATE_PARSE_VALUES(unsigned char)
+        CLIAP_INSTANTIATE_PARSE_VALUES(short)
+        CLIAP_INSTANTIATE_PARSE_VALUES(unsigned short)
+        CLIAP_INSTANTIATE_PARSE_VALUES(int)
+        CLIAP_INSTANTIATE_PARSE_VALUES(unsigned int)
+        CLIAP_INSTANTIATE_PARSE_VALUES(long)
+        CLIAP_INSTANTIATE_PARSE_VALUES(unsigned long)
+        CLIAP_INSTANTIATE_PARSE_VALUES(long long)
+        CLIAP_INSTANTIATE_PARSE_VALUES(unsigned long long)
+        CLIAP_INSTANTIATE_PARSE_VALUES(float)
+        CLIAP_INSTANTIATE_PARSE_VALUES(double)
+        CLIAP_INSTANTIATE_PARSE_VALUES(long double)
+
+#undef CLIAP_INSTANTIATE_PARSE_VALUES
+    }
+}
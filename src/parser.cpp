@@ -8,10 +8,10 @@ namespace cliap
 
     namespace {
         std::string rtrim_copy(std::string_view str, std::string_view pattern) {
-            if (const auto pos = str.rfind(pattern.data()); pos != std::string_view::npos)
-                return std::string{str.data(), pos};
+            if (const auto pos = str.find_last_not_of(pattern); pos != std::string_view::npos)
+                return std::string{str.data(), pos + 1};
 
-            return std::string{str};
+            return {};
         }
 
         std::vector<std::string> split(const std::string& str, std::string_view delimeter)
@@ -210,44 +210,97 @@ namespace cliap
         if (parm_count < required_args_count())
             return {"Not all required arguments are specified"};
 
-        for (std::size_t i = 1; i < args.size(); ++i) {
-            std::string parm{args[i]};
-            ltrim(parm, '-');
-            std::string parm_name, parm_value;
+        if (args.empty())
+            return check_required_args();
 
-            // check for short parm_name case
-            if (parm.size() != 1) {
-                if (!parse_key_arg(parm, parm_name, parm_value))
-                    return {"Parameter format parse error: " + std::string{parm}};
-            } else {
-                parm_name = parm;
-            }
+        return parse(std::next(args.cbegin()), args.cend());
+    }
 
-            const auto it_arg = params_map_.find(parm_name);
-            if (it_arg != params_map_.end()) {
-                auto parg{it_arg->second};
-                if (parg->is_flag()) {
-                    parg->set_parsed(true);
-                    continue;
-                }
+    std::optional<std::string> ArgParser::parse(std::istream& input, const ArgCallback& on_arg, char delim)
+    {
+        std::string pending_key;
 
-                // The case when the Param parm_name is given in a short form
-                // and requires its parm_value, but the parm_value is not provided
-                if (parm_value.empty()) {
-                    if (i == parm_count)
-                        return {"Expected value for the key: " + parm_name};
+        for (std::string token; std::getline(input, token, delim);) {
+            if (delim == '\n' && !token.empty() && token.back() == '\r')
+                token.pop_back();
 
-                    parm_value = args[i + 1];
-                    ++i;
-                }
+            if (token.empty()) {
+                if (!pending_key.empty())
+                    return {"Expected value for the key: " + pending_key};
 
-                parg->value(parm_value);
-                parg->set_parsed(true);
-            } else {
-                return {"An unknown parameter key is specified: " + parm};
+                continue;
             }
+
+            if (auto err = parse_token(token, pending_key, on_arg))
+                return err;
+        }
+
+        if (input.bad())
+            return {"Input stream read error"};
+
+        return finish_parse(pending_key);
+    }
+
+    std::optional<std::string> ArgParser::parse_token(std::string_view token, std::string& pending_key, const ArgCallback& on_arg)
+    {
+        // The previous token was a key given without its value
+        if (!pending_key.empty()) {
+            const auto parg{params_map_.at(pending_key)};
+            pending_key.clear();
+
+            parg->value(std::string{token});
+            parg->set_parsed(true);
+            if (on_arg)
+                on_arg(*parg);
+
+            return {};
         }
 
+        std::string parm{token};
+        ltrim(parm, '-');
+        std::string parm_name, parm_value;
+
+        // check for short parm_name case
+        if (parm.size() != 1) {
+            if (!parse_key_arg(parm, parm_name, parm_value))
+                return {"Parameter format parse error: " + std::string{parm}};
+        } else {
+            parm_name = parm;
+        }
+
+        const auto it_arg = params_map_.find(parm_name);
+        if (it_arg == params_map_.end())
+            return {"An unknown parameter key is specified: " + parm};
+
+        auto parg{it_arg->second};
+        if (parg->is_flag()) {
+            parg->set_parsed(true);
+            if (on_arg)
+                on_arg(*parg);
+
+            return {};
+        }
+
+        // The case when the Param parm_name is given in a short form
+        // and requires its parm_value, which is expected in the next token
+        if (parm_value.empty()) {
+            pending_key = parm_name;
+            return {};
+        }
+
+        parg->value(parm_value);
+        parg->set_parsed(true);
+        if (on_arg)
+            on_arg(*parg);
+
+        return {};
+    }
+
+    std::optional<std::string> ArgParser::finish_parse(const std::string& pending_key) const
+    {
+        if (!pending_key.empty())
+            return {"Expected value for the key: " + pending_key};
+
         return check_required_args();
     }
 
@@ -3,7 +3,11 @@
 #include <cliap/cliap.h>
 
 #include <doctest.h>
+#include <list>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -59,6 +63,105 @@ TEST_SUITE("Testing cliap::Arg" * doctest::description("Class cliap::Arg tests")
         parm.value("abcd"s);
         CHECK(parm.get_value_as_str() == "abcd"s);
     }
+
+    TEST_CASE("Testing cliap::Arg class get_values_as method") {
+        cliap::Arg parm;
+
+        parm.value("1, 2,3 ,40"s);
+        CHECK(parm.get_values_as<std::vector<int>>() == std::vector<int>{1, 2, 3, 40});
+
+        parm.value("+1,\t2\t, -3"s);
+        CHECK(parm.get_values_as<std::vector<int>>() == std::vector<int>{1, 2, -3});
+
+        parm.value("0.5;0.25;-3e2"s);
+        CHECK(parm.get_values_as<std::vector<double>>(';') == std::vector<double>{0.5, 0.25, -300.0});
+
+        parm.value(""s);
+        CHECK(parm.get_values_as<std::vector<int>>().empty());
+
+        parm.value("7, 8"s);
+        CHECK(parm.get_values_as<std::list<long>>() == std::list<long>{7, 8});
+
+        parm.value("1,2x,3"s);
+        CHECK_THROWS_WITH_AS(parm.get_values_as<std::vector<int>>(),
+            "Invalid list element #1 at position 3 (not a number): '2x'", std::runtime_error);
+
+        parm.value("1,99999"s);
+        CHECK_THROWS_WITH_AS(parm.get_values_as<std::vector<std::uint16_t>>(),
+            "Invalid list element #1 at position 2 (out of range): '99999'", std::runtime_error);
+
+        parm.value("1,2,"s);
+        CHECK_THROWS_AS(parm.get_values_as<std::vector<int>>(), std::runtime_error);
+    }
+
+    TEST_CASE("Testing cliap::Arg class get_values_as method with caller buffer") {
+        cliap::Arg parm;
+        std::uint32_t buf[3]{};
+
+        SUBCASE("Checking the complete list") {
+            parm.value("5,6,7"s);
+            const auto values = parm.get_values_as(buf, 3);
+
+            CHECK(!values.error.has_value());
+            CHECK(values.data == buf);
+            CHECK(values.size == 3);
+            CHECK(buf[2] == 7u);
+        }
+
+        SUBCASE("Checking the empty element") {
+            parm.value("5,,7"s);
+            const auto values = parm.get_values_as(buf, 3);
+
+            REQUIRE(values.error.has_value());
+            CHECK(values.size == 1);
+            CHECK(values.error->index == 1);
+            CHECK(values.error->position == 2);
+            CHECK(values.error->reason == std::errc::invalid_argument);
+        }
+
+        SUBCASE("Checking the blank element at the end of the value") {
+            parm.value("5,"s);
+            const auto values = parm.get_values_as(buf, 3);
+
+            REQUIRE(values.error.has_value());
+            CHECK(values.error->index == 1);
+            CHECK(values.error->position == 1);
+            CHECK(values.error->reason == std::errc::invalid_argument);
+        }
+
+        SUBCASE("Checking the element that is not a number") {
+            parm.value("5,6,x"s);
+            const auto values = parm.get_values_as(buf, 2);
+
+            REQUIRE(values.error.has_value());
+            CHECK(values.size == 2);
+            CHECK(values.error->index == 2);
+            CHECK(values.error->position == 4);
+            CHECK(values.error->reason == std::errc::invalid_argument);
+        }
+
+        SUBCASE("Checking the element that does not fit into the type") {
+            parm.value("5,6,4294967296"s);
+            const auto values = parm.get_values_as(buf, 3);
+
+            REQUIRE(values.error.has_value());
+            CHECK(values.size == 2);
+            CHECK(values.error->index == 2);
+            CHECK(values.error->position == 4);
+            CHECK(values.error->reason == std::errc::result_out_of_range);
+        }
+
+        SUBCASE("Checking the full buffer") {
+            parm.value("5,6,7"s);
+            const auto values = parm.get_values_as(buf, 2);
+
+            REQUIRE(values.error.has_value());
+            CHECK(values.size == 2);
+            CHECK(values.error->index == 2);
+            CHECK(values.error->position == 4);
+            CHECK(values.error->reason == std::errc::value_too_large);
+        }
+    }
 }
 
 TEST_SUITE("Testing cliap::ArgParser" * doctest::description("Class cliap::ArgParser tests")) {
@@ -173,3 +276,108 @@ TEST_SUITE("Testing cliap::ArgParser" * doctest::description("Class cliap::ArgPa
     }
 }
 
+
+TEST_SUITE("Testing cliap::ArgParser stream parsing" * doctest::description("Incremental cliap::ArgParser parsing tests")) {
+    TEST_CASE("Testing cliap::ArgParser parse from input stream") {
+        std::istringstream input{"--id=1\n-v\n--id=2\n\n-n\nnode a\n--id=3\n"};
+
+        cliap::ArgParser cli_parser;
+        cli_parser
+            .add_parameter(cliap::Arg().short_name("-v").long_name("--verbose").flag())
+            .add_parameter(cliap::Arg().short_name("-n").long_name("--name").required())
+            .add_parameter(cliap::Arg().long_name("--id"));
+
+        std::vector<std::string> ids;
+        const auto err = cli_parser.parse(input, [&ids](const cliap::Arg& arg) {
+            if (arg.long_name() == "id"s)
+                ids.push_back(arg.value());
+        });
+
+        CHECK(!err.has_value());
+        CHECK(ids == std::vector<std::string>{"1", "2", "3"});
+        CHECK(cli_parser.arg("v"s).is_parsed());
+        CHECK(cli_parser.arg("name"s).get_value_as_str() == "node a"s);
+        CHECK(cli_parser.arg("id"s).get_value_as<int>() == 3);
+    }
+
+    TEST_CASE("Testing cliap::ArgParser parse from input stream with values containing spaces") {
+        cliap::ArgParser cli_parser;
+        cli_parser.add_parameter(cliap::Arg().short_name("-n").long_name("--name").required());
+
+        SUBCASE("Checking one token per line") {
+            std::istringstream input{"--name=hello world\n"};
+
+            CHECK(!cli_parser.parse(input).has_value());
+            CHECK(cli_parser.arg("name"s).get_value_as_str() == "hello world"s);
+        }
+
+        SUBCASE("Checking a custom token delimiter") {
+            std::istringstream input{"--name=hello world\0-n\0hi there"s};
+
+            CHECK(!cli_parser.parse(input, {}, '\0').has_value());
+            CHECK(cli_parser.arg("name"s).get_value_as_str() == "hi there"s);
+        }
+
+        SUBCASE("Checking CRLF line endings") {
+            std::istringstream input{"--name=hello world\r\n-n\r\nhi\r\n"};
+
+            CHECK(!cli_parser.parse(input).has_value());
+            CHECK(cli_parser.arg("name"s).get_value_as_str() == "hi"s);
+        }
+    }
+
+    TEST_CASE("Testing cliap::ArgParser parse from input stream errors") {
+        cliap::ArgParser cli_parser;
+        cli_parser
+            .add_parameter(cliap::Arg().short_name("-n").long_name("--name"))
+            .add_parameter(cliap::Arg().long_name("--id"));
+
+        SUBCASE("Checking the empty line in place of a value") {
+            std::istringstream input{"-n\n\n--id=3\n"};
+
+            const auto err = cli_parser.parse(input);
+            REQUIRE(err.has_value());
+            CHECK(*err == "Expected value for the key: n"s);
+            CHECK(cli_parser.arg("id"s).get_value_as_str().empty());
+        }
+
+        SUBCASE("Checking the stream read failure") {
+            std::istringstream input{"--id=3\n"};
+            input.setstate(std::ios::badbit);
+
+            const auto err = cli_parser.parse(input);
+            REQUIRE(err.has_value());
+            CHECK(*err == "Input stream read error"s);
+        }
+    }
+
+    TEST_CASE("Testing cliap::ArgParser parse from iterators") {
+        const std::vector<std::string> tokens{"--port=8080", "-a"};
+
+        cliap::ArgParser cli_parser;
+        cli_parser
+            .add_parameter(cliap::Arg().short_name("-p").long_name("--port").required())
+            .add_parameter(cliap::Arg().short_name("-a").long_name("--ip-address").required());
+
+        SUBCASE("Checking the missing value at the end of input") {
+            const auto err = cli_parser.parse(tokens.cbegin(), tokens.cend());
+
+            REQUIRE(err.has_value());
+            CHECK(*err == "Expected value for the key: a"s);
+        }
+
+        SUBCASE("Checking the required parameters at the end of input") {
+            const auto err = cli_parser.parse(tokens.cbegin(), std::prev(tokens.cend()));
+
+            REQUIRE(err.has_value());
+            CHECK(*err == "Expected required parameter value: a [ip-address]"s);
+        }
+
+        SUBCASE("Checking string_view tokens") {
+            const std::vector<std::string_view> views{"--port=8080", "-a", "127.0.0.1"};
+
+            CHECK(!cli_parser.parse(views.cbegin(), views.cend()).has_value());
+            CHECK(cli_parser.arg("a"s).get_value_as_str() == "127.0.0.1"s);
+        }
+    }
+}